@@ -1,14 +1,15 @@
 #pragma once
 
 #include "glm/glm.hpp"
-#include <unordered_map>
+#include <array>
+#include <cstdint>
+#include <optional>
 
 #include "animator.hpp"
+#include "control/mesh.hpp"
+#include "render_mesh.hpp"
 
 struct GLFWwindow;
-class  RenderMesh;
-
-namespace Subdiv::Control { class Mesh; }
 
 class App {
 public:
@@ -49,21 +50,35 @@ private:
     const char* title;
     GLFWwindow* window;
 
-    // Key state tracking
-    std::unordered_map<int, bool> keyPressed;
-    std::unordered_map<int, bool> keyPressedLastFrame;
+    // Key state tracking - flat arrays indexed by GLFW key code
+    // (covers GLFW_KEY_LAST without pulling the GLFW header in here)
+    static constexpr int kMaxKeys = 512;
+    std::array<uint8_t, kMaxKeys> keyPressed{};
+    std::array<uint8_t, kMaxKeys> keyPressedLastFrame{};
 
-    // Mesh data
-    Subdiv::Control::Mesh* mesh;
-    RenderMesh* renderMesh = nullptr;
+    // Mesh data - owned by value; RenderMesh references mesh so it is
+    // constructed after it (hence optional)
+    Subdiv::Control::Mesh     mesh;
+    std::optional<RenderMesh> renderMesh;
 
     // OpenGL resources
     unsigned int shaderProgram = 0;
-    unsigned int wireframeProgram = 0;
     unsigned int vao = 0;
     unsigned int vbo = 0;
     unsigned int ebo = 0;
-    unsigned int wireframeEBO = 0;
+
+    // Byte offset of the wireframe line indices inside the shared EBO
+    size_t wireframeOffsetBytes = 0;
+
+    // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT, depending on mesh size
+    unsigned int indexType = 0;
+
+    // Persistent mapping of the position VBO (animation streaming)
+    void* vboMappedPtr = nullptr;
+
+    // Cached uniform locations (resolved once after linking)
+    int mvpLoc = -1;
+    int colorLoc = -1;
 
     // Camera parameters
     glm::vec3 cameraTarget = glm::vec3(0.0f, 0.0f, 0.0f);  // Look at target
@@ -77,7 +92,9 @@ private:
     // Rendering state
     glm::mat4 projection;
     glm::mat4 view;
+    glm::mat4 viewProj;   // projection * view, rebuilt only on camera/resize
     glm::mat4 model;
+    bool      mvpDirty = true;  // re-upload the mvp uniform only when it changed
 
     bool  showWireframe = true;
     bool  showSolid     = true;
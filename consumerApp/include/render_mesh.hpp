@@ -32,6 +32,8 @@ public:
     /**
      * @brief Build index buffers from mesh.
      * Call after mesh topology changes.
+     *
+     * Requires the mesh's TopologyCache to be built (mesh.buildCache()).
      */
     void build();
     
@@ -45,50 +47,65 @@ public:
      */
     bool isValid() const { return valid_; }
     
+    // Index Width =============================================================
+
+    /**
+     * @brief True when the mesh fits in 16-bit indices (< 65536 vertices).
+     *
+     * The GPU upload accessors below then return uint16_t data, halving
+     * index-buffer size and fetch bandwidth. The 32-bit vectors remain the
+     * canonical CPU-side representation.
+     */
+    bool usesShortIndices() const { return shortIndices_; }
+
+    size_t indexSize() const { return shortIndices_ ? sizeof(uint16_t) : sizeof(uint32_t); }
+
     // Triangle Indices (for solid rendering) =================================
-    
+
     /**
      * @brief Get triangle indices (fan triangulation).
      * Each face is triangulated as a fan from the first vertex.
      */
-    const std::vector<uint32_t>& getTriangleIndices() const { 
-        return triangleIndices_; 
+    const std::vector<uint32_t>& getTriangleIndices() const {
+        return triangleIndices_;
     }
-    
-    const void* getTriangleIndicesData() const { 
-        return triangleIndices_.data(); 
+
+    const void* getTriangleIndicesData() const {
+        return shortIndices_ ? static_cast<const void*>(triangleIndices16_.data())
+                             : static_cast<const void*>(triangleIndices_.data());
     }
-    
-    size_t getTriangleIndicesBytes() const { 
-        return triangleIndices_.size() * sizeof(uint32_t); 
+
+    size_t getTriangleIndicesBytes() const {
+        return triangleIndices_.size() * indexSize();
     }
-    
-    size_t numTriangles() const { 
-        return triangleIndices_.size() / 3; 
+
+    size_t numTriangles() const {
+        return triangleIndices_.size() / 3;
     }
-    
+
     // Wireframe Indices (for edge rendering) =================================
-    
+
     /**
      * @brief Get wireframe indices (unique edges).
      * Each edge appears once as [v0, v1].
      */
-    const std::vector<uint32_t>& getWireframeIndices() const { 
-        return wireframeIndices_; 
+    const std::vector<uint32_t>& getWireframeIndices() const {
+        return wireframeIndices_;
     }
-    
-    const void* getWireframeIndicesData() const { 
-        return wireframeIndices_.data(); 
+
+    const void* getWireframeIndicesData() const {
+        return shortIndices_ ? static_cast<const void*>(wireframeIndices16_.data())
+                             : static_cast<const void*>(wireframeIndices_.data());
     }
-    
-    size_t getWireframeIndicesBytes() const { 
-        return wireframeIndices_.size() * sizeof(uint32_t); 
+
+    size_t getWireframeIndicesBytes() const {
+        return wireframeIndices_.size() * indexSize();
     }
-    
-    size_t numWireframeLines() const { 
-        return wireframeIndices_.size() / 2; 
+
+    size_t numWireframeLines() const {
+        return wireframeIndices_.size() / 2;
     }
-    
+
     // Statistics =============================================================
     
     size_t getMemoryUsage() const;
@@ -98,9 +115,16 @@ private:
     
     std::vector<uint32_t> triangleIndices_;
     std::vector<uint32_t> wireframeIndices_;
-    
-    bool valid_ = false;
-    
+
+    // 16-bit mirrors for GPU upload (populated when vertex count < 65536)
+    std::vector<uint16_t> triangleIndices16_;
+    std::vector<uint16_t> wireframeIndices16_;
+
+    bool valid_        = false;
+    bool shortIndices_ = false;
+
     void buildTriangleIndices();
     void buildWireframeIndices();
+    void optimizeTriangleOrder();
+    void compressIndices();
 };
@@ -4,7 +4,11 @@
 #include <GLFW/glfw3.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <span>
+#include <string>
 
 #include "control/mesh.hpp"
 #include "render_mesh.hpp"
@@ -35,16 +39,34 @@ void main()
 }
 )";
 
-// Wireframe fragment shader
-const char* wireframeFragmentSource = R"(
-#version 460 core
-out vec4 FragColor;
+// Query the info log only on failure - the success path touches nothing
+static bool checkShader(unsigned int shader, const char* name)
+{
+    int success = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (success) return true;
+
+    int logLength = 0;
+    glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &logLength);
+    std::string infoLog(logLength > 0 ? logLength : 1, '\0');
+    glGetShaderInfoLog(shader, logLength, nullptr, infoLog.data());
+    std::cerr << name << " compilation failed:\n" << infoLog << "\n";
+    return false;
+}
 
-void main()
+static bool checkProgram(unsigned int program, const char* name)
 {
-    FragColor = vec4(0.0, 1.0, 0.0, 1.0); // Green wireframe
+    int success = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (success) return true;
+
+    int logLength = 0;
+    glGetProgramiv(program, GL_INFO_LOG_LENGTH, &logLength);
+    std::string infoLog(logLength > 0 ? logLength : 1, '\0');
+    glGetProgramInfoLog(program, logLength, nullptr, infoLog.data());
+    std::cerr << name << " linking failed:\n" << infoLog << "\n";
+    return false;
 }
-)";
 
 App::App(int w, int h, const char* t) : width(w), height(h), title(t), window(nullptr) {}
 
@@ -120,149 +142,124 @@ bool App::InitShaders()
     unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
     glShaderSource(vertexShader, 1, &vertexShaderSource, nullptr);
     glCompileShader(vertexShader);
-    
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(vertexShader, 512, nullptr, infoLog);
-        std::cerr << "Vertex shader compilation failed:\n" << infoLog << "\n";
-        return false;
-    }
+    if (!checkShader(vertexShader, "Vertex shader")) return false;
 
     // Compile fragment shader (solid)
     unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
     glShaderSource(fragmentShader, 1, &fragmentShaderSource, nullptr);
     glCompileShader(fragmentShader);
-    
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(fragmentShader, 512, nullptr, infoLog);
-        std::cerr << "Fragment shader compilation failed:\n" << infoLog << "\n";
-        return false;
-    }
+    if (!checkShader(fragmentShader, "Fragment shader")) return false;
 
     // Link solid shader program
     shaderProgram = glCreateProgram();
     glAttachShader(shaderProgram, vertexShader);
     glAttachShader(shaderProgram, fragmentShader);
     glLinkProgram(shaderProgram);
-    
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgram, 512, nullptr, infoLog);
-        std::cerr << "Shader program linking failed:\n" << infoLog << "\n";
-        return false;
-    }
-
-    // Compile wireframe fragment shader
-    unsigned int wireframeFragment = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(wireframeFragment, 1, &wireframeFragmentSource, nullptr);
-    glCompileShader(wireframeFragment);
-    
-    glGetShaderiv(wireframeFragment, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(wireframeFragment, 512, nullptr, infoLog);
-        std::cerr << "Wireframe fragment shader compilation failed:\n" << infoLog << "\n";
-        return false;
-    }
-
-    // Link wireframe shader program
-    wireframeProgram = glCreateProgram();
-    glAttachShader(wireframeProgram, vertexShader);
-    glAttachShader(wireframeProgram, wireframeFragment);
-    glLinkProgram(wireframeProgram);
-    
-    glGetProgramiv(wireframeProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(wireframeProgram, 512, nullptr, infoLog);
-        std::cerr << "Wireframe shader program linking failed:\n" << infoLog << "\n";
-        return false;
-    }
+    if (!checkProgram(shaderProgram, "Shader program")) return false;
 
     // Clean up shaders (no longer needed after linking)
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
-    glDeleteShader(wireframeFragment);
+
+    // Resolve uniform locations once - they are constant for a linked program
+    mvpLoc   = glGetUniformLocation(shaderProgram, "mvp");
+    colorLoc = glGetUniformLocation(shaderProgram, "color");
 
     std::cout << "Shaders compiled and linked successfully\n";
     return true;
 }
 
+// Demo cube geometry - compile-time constant, fed through the normal
+// Mesh::addVertex/addFace path so the full library pipeline is exercised.
+static constexpr glm::vec3 kCubeVerts[8] = {
+    {-1, -1, -1}, { 1, -1, -1}, { 1,  1, -1}, {-1,  1, -1},
+    {-1, -1,  1}, { 1, -1,  1}, { 1,  1,  1}, {-1,  1,  1},
+};
+
+static constexpr Subdiv::Control::VertexIndex kCubeQuads[6][4] = {
+    {0, 1, 2, 3}, // Front
+    {5, 4, 7, 6}, // Back
+    {4, 0, 3, 7}, // Left
+    {1, 5, 6, 2}, // Right
+    {3, 2, 6, 7}, // Top
+    {4, 5, 1, 0}, // Bottom
+};
+
 bool App::InitMesh()
 {
     using namespace Subdiv;
 
-    mesh = new Control::Mesh();
-
     // Create a simple cube
-    auto v0 = mesh->addVertex({-1, -1, -1});
-    auto v1 = mesh->addVertex({ 1, -1, -1});
-    auto v2 = mesh->addVertex({ 1,  1, -1});
-    auto v3 = mesh->addVertex({-1,  1, -1});
-    auto v4 = mesh->addVertex({-1, -1,  1});
-    auto v5 = mesh->addVertex({ 1, -1,  1});
-    auto v6 = mesh->addVertex({ 1,  1,  1});
-    auto v7 = mesh->addVertex({-1,  1,  1});
+    mesh.reserve(8, 24, 6); // 6 quads -> 24 half-edges
+
+    for (const glm::vec3& p : kCubeVerts)
+        mesh.addVertex(p);
 
     // Add faces (quads)
-    mesh->addFace({v0, v1, v2, v3}); // Front
-    mesh->addFace({v5, v4, v7, v6}); // Back
-    mesh->addFace({v4, v0, v3, v7}); // Left
-    mesh->addFace({v1, v5, v6, v2}); // Right
-    mesh->addFace({v3, v2, v6, v7}); // Top
-    mesh->addFace({v4, v5, v1, v0}); // Bottom
+    for (const auto& quad : kCubeQuads)
+        mesh.addFace(std::span<const Control::VertexIndex>(quad));
 
     std::cout << "Created cube: " 
-              << mesh->numVertices() << " vertices, "
-              << mesh->numFaces() << " faces, "
-              << mesh->numEdges() << " edges\n";
+              << mesh.numVertices() << " vertices, "
+              << mesh.numFaces() << " faces, "
+              << mesh.numEdges() << " edges\n";
 
     // Build topology cache
-    mesh->buildCache();
+    mesh.buildCache();
     
     // Create render mesh
-    renderMesh = new RenderMesh(*mesh);
+    renderMesh.emplace(mesh);
     renderMesh->build();
 
     std::cout << "RenderMesh: "
               << renderMesh->numTriangles() << " triangles, "
               << renderMesh->numWireframeLines() << " lines\n";
 
-    // Setup VAO
-    glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
-
-    // Upload vertex positions
-    glGenBuffers(1, &vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER,
-                 mesh->getPositionsBytes(),
-                 mesh->getPositionsData(),
-                 GL_DYNAMIC_DRAW);
-
-    animator.init(mesh);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-    glEnableVertexAttribArray(0);
-
-    // Upload triangle indices
-    glGenBuffers(1, &ebo);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                 renderMesh->getTriangleIndicesBytes(),
-                 renderMesh->getTriangleIndicesData(),
-                 GL_STATIC_DRAW);
-
-    // Upload wireframe indices (separate buffer)
-    glGenBuffers(1, &wireframeEBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, wireframeEBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-             renderMesh->getWireframeIndicesBytes(),
-             renderMesh->getWireframeIndicesData(),
-             GL_STATIC_DRAW);
-    
-    glBindVertexArray(0);
+    // GL object setup - DSA throughout, so nothing below touches the global
+    // binding state.
+
+    // Vertex positions in immutable storage, persistently mapped so animation
+    // updates are a plain memcpy instead of a driver round-trip.
+    constexpr GLbitfield kStreamFlags =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    glCreateBuffers(1, &vbo);
+    glNamedBufferStorage(vbo,
+                         mesh.getPositionsBytes(),
+                         mesh.getPositionsData(),
+                         kStreamFlags);
+    vboMappedPtr = glMapNamedBufferRange(vbo, 0,
+                                         mesh.getPositionsBytes(),
+                                         kStreamFlags);
+
+    animator.init(&mesh);
+
+    indexType = renderMesh->usesShortIndices() ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+    // Upload triangle + wireframe indices into a single EBO.
+    // Triangles start at offset 0, lines at wireframeOffsetBytes, so both
+    // passes share one buffer binding and differ only by draw offset.
+    wireframeOffsetBytes = renderMesh->getTriangleIndicesBytes();
+
+    glCreateBuffers(1, &ebo);
+    glNamedBufferData(ebo,
+                      renderMesh->getTriangleIndicesBytes() + renderMesh->getWireframeIndicesBytes(),
+                      nullptr,
+                      GL_STATIC_DRAW);
+    glNamedBufferSubData(ebo, 0,
+                         renderMesh->getTriangleIndicesBytes(),
+                         renderMesh->getTriangleIndicesData());
+    glNamedBufferSubData(ebo, wireframeOffsetBytes,
+                         renderMesh->getWireframeIndicesBytes(),
+                         renderMesh->getWireframeIndicesData());
+
+    // VAO: position attribute from vbo, element buffer attached directly
+    glCreateVertexArrays(1, &vao);
+    glVertexArrayVertexBuffer(vao, 0, vbo, 0, sizeof(glm::vec3));
+    glVertexArrayAttribFormat(vao, 0, 3, GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayAttribBinding(vao, 0, 0);
+    glEnableVertexArrayAttrib(vao, 0);
+    glVertexArrayElementBuffer(vao, ebo);
 
     std::cout << "Mesh uploaded to GPU\n";
     return true;
@@ -270,38 +267,47 @@ bool App::InitMesh()
 
 void App::CleanupGL()
 {
-    if(mesh != nullptr)
-        delete mesh;
-    mesh = nullptr;
+    renderMesh.reset();
+    mesh.clear();
+
+    if (vboMappedPtr)
+    {
+        glUnmapNamedBuffer(vbo);
+        vboMappedPtr = nullptr;
+    }
 
     if (vao) glDeleteVertexArrays(1, &vao);
     if (vbo) glDeleteBuffers(1, &vbo);
     if (ebo) glDeleteBuffers(1, &ebo);
-    if (wireframeEBO) glDeleteBuffers(1, &wireframeEBO);
     if (shaderProgram) glDeleteProgram(shaderProgram);
-    if (wireframeProgram) glDeleteProgram(wireframeProgram);
-    
-    delete renderMesh;
 }
 
 void App::UpdateProjection()
 {
     float aspect = (float)width / (float)height;
     projection = glm::perspective(glm::radians(fov), aspect, nearPlane, farPlane);
+    viewProj   = projection * view;
+    mvpDirty   = true;
 }
 
 void App::UpdateCamera()
 {
-    // Convert spherical coordinates to cartesian
-    float yawRad = glm::radians(cameraYaw);
+    // Convert spherical coordinates to cartesian - evaluate sin/cos once per
+    // angle (paired calls let the compiler emit a single sincos each)
+    float yawRad   = glm::radians(cameraYaw);
     float pitchRad = glm::radians(cameraPitch);
-    
+
+    float sinYaw   = std::sin(yawRad),   cosYaw   = std::cos(yawRad);
+    float sinPitch = std::sin(pitchRad), cosPitch = std::cos(pitchRad);
+
     glm::vec3 cameraPos;
-    cameraPos.x = cameraTarget.x + cameraDistance * cos(pitchRad) * sin(yawRad);
-    cameraPos.y = cameraTarget.y + cameraDistance * sin(pitchRad);
-    cameraPos.z = cameraTarget.z + cameraDistance * cos(pitchRad) * cos(yawRad);
+    cameraPos.x = cameraTarget.x + cameraDistance * cosPitch * sinYaw;
+    cameraPos.y = cameraTarget.y + cameraDistance * sinPitch;
+    cameraPos.z = cameraTarget.z + cameraDistance * cosPitch * cosYaw;
     
-    view = glm::lookAt(cameraPos, cameraTarget, glm::vec3(0.0f, 1.0f, 0.0f));
+    view     = glm::lookAt(cameraPos, cameraTarget, glm::vec3(0.0f, 1.0f, 0.0f));
+    viewProj = projection * view;
+    mvpDirty = true;
 }
 
 void App::Run() {
@@ -361,12 +367,10 @@ void App::Update() {
         time += 0.016f; // ~60fps fixed step;
         animator.update(time);
 
-        // Stream updated positions to GPU - Usually would do it on REnder
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glBufferSubData(GL_ARRAY_BUFFER, 0,
-                        mesh->getPositionsBytes(),
-                        mesh->getPositionsData());
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        // Stream updated positions through the persistent mapping - coherent
+        // bit makes the write visible to the GPU without an explicit flush
+        if (vboMappedPtr)
+            std::memcpy(vboMappedPtr, mesh.getPositionsData(), mesh.getPositionsBytes());
     }
 }
 
@@ -376,46 +380,39 @@ void App::Render() {
 
     // Future: render meshes here
 
-    // Compute MVP matrix
-    glm::mat4 mvp = projection * view * model;
-
+    // Both passes share one program, one VAO and one EBO - only the color
+    // uniform and the draw offset differ. The element buffer is attached to
+    // the VAO (glVertexArrayElementBuffer), so binding the VAO is enough.
     glBindVertexArray(vao);
+    glUseProgram(shaderProgram);
+
+    // Recompute/upload the MVP only when the camera or projection changed -
+    // uniform state persists with the program, so a clean frame skips both
+    if (mvpDirty)
+    {
+        glm::mat4 mvp = viewProj * model;
+        glUniformMatrix4fv(mvpLoc, 1, GL_FALSE, glm::value_ptr(mvp));
+        mvpDirty = false;
+    }
 
     // Render solid mesh
     if (showSolid)
     {
-        glUseProgram(shaderProgram);
-        
-        // Set uniforms
-        int mvpLoc = glGetUniformLocation(shaderProgram, "mvp");
-        glUniformMatrix4fv(mvpLoc, 1, GL_FALSE, glm::value_ptr(mvp));
-        
-        int colorLoc = glGetUniformLocation(shaderProgram, "color");
         glUniform3f(colorLoc, 0.3f, 0.3f, 0.8f); // Blue
-        
-        // Draw triangles
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-        glDrawElements(GL_TRIANGLES, 
-                       renderMesh->numTriangles() * 3, 
-                       GL_UNSIGNED_INT, 
+        glDrawElements(GL_TRIANGLES,
+                       renderMesh->numTriangles() * 3,
+                       indexType,
                        nullptr);
     }
 
     // Render wireframe
     if (showWireframe)
     {
-        glUseProgram(wireframeProgram);
-        
-        // Set uniforms
-        int mvpLoc = glGetUniformLocation(wireframeProgram, "mvp");
-        glUniformMatrix4fv(mvpLoc, 1, GL_FALSE, glm::value_ptr(mvp));
-        
-        // Draw lines
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, wireframeEBO);        
-        glDrawElements(GL_LINES, 
-                       renderMesh->numWireframeLines() * 2, 
-                       GL_UNSIGNED_INT, 
-                       nullptr);
+        glUniform3f(colorLoc, 0.0f, 1.0f, 0.0f); // Green
+        glDrawElements(GL_LINES,
+                       renderMesh->numWireframeLines() * 2,
+                       indexType,
+                       reinterpret_cast<const void*>(wireframeOffsetBytes));
     }
 
     glBindVertexArray(0);
@@ -423,6 +420,10 @@ void App::Render() {
 
 void App::OnKeyPress(int key, int action)
 {
+    // Track held state in the flat key array (O(1), no allocation)
+    if (key >= 0 && key < kMaxKeys)
+        keyPressed[key] = (action != GLFW_RELEASE);
+
     if (action != GLFW_PRESS) return;
     
     switch (key)
@@ -10,10 +10,22 @@ void RenderMesh::build()
     SUBDIV_PROFILE_FUNCTION();
     
     clear();
-    
+
+    // Exact-size reserves: fan triangulation emits (valence - 2) triangles
+    // per face, the wireframe one line per edge.
+    size_t triIndexCount = 0;
+    for (const auto& face : mesh_.faces)
+        if (face.valence >= 3)
+            triIndexCount += (face.valence - 2) * 3;
+
+    triangleIndices_.reserve(triIndexCount);
+    wireframeIndices_.reserve(mesh_.numEdges() * 2);
+
     buildTriangleIndices();
     buildWireframeIndices();
-    
+    optimizeTriangleOrder();
+    compressIndices();
+
     valid_ = true;
 }
 
@@ -21,64 +33,110 @@ void RenderMesh::clear()
 {
     triangleIndices_.clear();
     wireframeIndices_.clear();
+    triangleIndices16_.clear();
+    wireframeIndices16_.clear();
     valid_ = false;
+    shortIndices_ = false;
 }
 
 void RenderMesh::buildTriangleIndices()
 {
-    // Fan triangulation for each face
+    // Fan triangulation for each face: (v0, v1, v2), (v0, v2, v3), ...
+    // Triangles are emitted directly during the half-edge walk - only the fan
+    // anchor and the previous vertex are carried, no per-face scratch buffer.
     for (Subdiv::Control::FaceIndex f = 0; f < mesh_.numFaces(); ++f) {
         const auto& face = mesh_.faces[f];
-        
+
         if (face.valence < 3) continue;
-        
-        // Collect face vertices via half-edge traversal
-        std::vector<Subdiv::Control::VertexIndex> faceVerts;
-        faceVerts.reserve(face.valence);
-        
+
         Subdiv::Control::HalfEdgeIndex start = face.edge;
         if (start == Subdiv::Control::INVALID_INDEX || start >= mesh_.halfEdges.size()) continue;
-        
-        Subdiv::Control::HalfEdgeIndex current = start;
-        size_t count = 0;
-        
-        do 
+
+        // Fast paths for triangles and quads - Catmull-Clark output is
+        // all-quads after level 1, so valence 4 dominates real meshes.
+        // Well-formed faces let us chase .next without per-step checks.
+        if (face.valence == 3)
+        {
+            Subdiv::Control::HalfEdgeIndex h1 = mesh_.halfEdges[start].next;
+            if (h1 < mesh_.halfEdges.size())
+            {
+                Subdiv::Control::HalfEdgeIndex h2 = mesh_.halfEdges[h1].next;
+                if (h2 >= mesh_.halfEdges.size()) continue;
+                triangleIndices_.push_back(mesh_.getFromVertex(start));
+                triangleIndices_.push_back(mesh_.getFromVertex(h1));
+                triangleIndices_.push_back(mesh_.getFromVertex(h2));
+                continue;
+            }
+        }
+        else if (face.valence == 4)
         {
-            Subdiv::Control::VertexIndex v = mesh_.getFromVertex(current);
-            if (v != Subdiv::Control::INVALID_INDEX) 
-                faceVerts.push_back(v);
-            
+            Subdiv::Control::HalfEdgeIndex h1 = mesh_.halfEdges[start].next;
+            if (h1 < mesh_.halfEdges.size())
+            {
+                Subdiv::Control::HalfEdgeIndex h2 = mesh_.halfEdges[h1].next;
+                if (h2 >= mesh_.halfEdges.size()) continue;
+                Subdiv::Control::HalfEdgeIndex h3 = mesh_.halfEdges[h2].next;
+                if (h3 >= mesh_.halfEdges.size()) continue;
+                Subdiv::Control::VertexIndex a = mesh_.getFromVertex(start);
+                Subdiv::Control::VertexIndex b = mesh_.getFromVertex(h1);
+                Subdiv::Control::VertexIndex c = mesh_.getFromVertex(h2);
+                Subdiv::Control::VertexIndex d = mesh_.getFromVertex(h3);
+                triangleIndices_.push_back(a);
+                triangleIndices_.push_back(b);
+                triangleIndices_.push_back(c);
+                triangleIndices_.push_back(a);
+                triangleIndices_.push_back(c);
+                triangleIndices_.push_back(d);
+                continue;
+            }
+        }
+
+        Subdiv::Control::VertexIndex v0 = mesh_.getFromVertex(start);
+
+        Subdiv::Control::HalfEdgeIndex current = mesh_.halfEdges[start].next;
+        if (current == Subdiv::Control::INVALID_INDEX || current >= mesh_.halfEdges.size()) continue;
+
+        Subdiv::Control::VertexIndex vPrev = mesh_.getFromVertex(current);
+        current = mesh_.halfEdges[current].next;
+        size_t count = 2;
+
+        while (current != start && current != Subdiv::Control::INVALID_INDEX)
+        {
+            Subdiv::Control::VertexIndex vCur = mesh_.getFromVertex(current);
+
+            if (v0 != Subdiv::Control::INVALID_INDEX &&
+                vPrev != Subdiv::Control::INVALID_INDEX &&
+                vCur != Subdiv::Control::INVALID_INDEX)
+            {
+                triangleIndices_.push_back(v0);
+                triangleIndices_.push_back(vPrev);
+                triangleIndices_.push_back(vCur);
+            }
+
+            vPrev = vCur;
             current = mesh_.halfEdges[current].next;
             count++;
-            
+
             if (count > face.valence + 10) break; // Safety
-            
-        } 
-        while (current != start && current != Subdiv::Control::INVALID_INDEX);
-        
-        // Fan triangulation: (v0, v1, v2), (v0, v2, v3), ...
-        if (faceVerts.size() >= 3)
-        {
-            for (size_t i = 1; i + 1 < faceVerts.size(); ++i) {
-                triangleIndices_.push_back(faceVerts[0]);
-                triangleIndices_.push_back(faceVerts[i]);
-                triangleIndices_.push_back(faceVerts[i + 1]);
-            }
         }
     }
 }
 
 void RenderMesh::buildWireframeIndices()
 {
-    // Ensure cache is built
-    if (!mesh_.cache.isValid())
-        const_cast<Subdiv::Control::Mesh&>(mesh_).buildCache();
-    
-    // One line per edge (v0, v1)
-    for (Subdiv::Control::EdgeIndex e = 0; e < mesh_.numEdges(); ++e) 
+    // The caller owns the mesh mutably and must have built the cache;
+    // rebuilding it here through a const_cast hid both the mutation and a
+    // redundant full-topology traversal.
+    SUBDIV_ASSERT(mesh_.cache.isValid(), "TopologyCache must be built before RenderMesh::build");
+    if (!mesh_.cache.isValid()) return;
+
+
+    // One line per edge (v0, v1). Scan the cache's endpoint array directly -
+    // a sequential read instead of a bounds-checked lookup per edge.
+    const auto& edgeVertices = mesh_.cache.getEdgeVerticesArray();
+    for (const auto& [v0, v1] : edgeVertices)
     {
-        auto [v0, v1] = mesh_.cache.getEdgeVertices(e);
-        if (v0 != Subdiv::Control::INVALID_INDEX && v1 != Subdiv::Control::INVALID_INDEX) 
+        if (v0 != Subdiv::Control::INVALID_INDEX && v1 != Subdiv::Control::INVALID_INDEX)
         {
             wireframeIndices_.push_back(v0);
             wireframeIndices_.push_back(v1);
@@ -86,8 +144,125 @@ void RenderMesh::buildWireframeIndices()
     }
 }
 
+void RenderMesh::optimizeTriangleOrder()
+{
+    // Greedy post-transform-cache reorder (tipsify-style, Sander et al. 2007).
+    // Face-order emission scatters vertex reuse on large subdivided meshes;
+    // fanning triangles around one vertex at a time keeps recently transformed
+    // vertices hot in the GPU's post-T&L cache.
+    constexpr uint32_t kCacheSize = 32;
+
+    const size_t numVerts = mesh_.numVertices();
+    const size_t numTris  = triangleIndices_.size() / 3;
+    if (numTris < 2) return;
+
+    // Vertex -> triangle adjacency (CSR)
+    std::vector<uint32_t> liveTris(numVerts, 0);
+    for (uint32_t idx : triangleIndices_)
+        liveTris[idx]++;
+
+    std::vector<uint32_t> adjOffsets(numVerts + 1, 0);
+    for (size_t v = 0; v < numVerts; ++v)
+        adjOffsets[v + 1] = adjOffsets[v] + liveTris[v];
+
+    std::vector<uint32_t> adj(triangleIndices_.size());
+    {
+        std::vector<uint32_t> writePos(adjOffsets.begin(), adjOffsets.end() - 1);
+        for (size_t t = 0; t < numTris; ++t)
+            for (size_t c = 0; c < 3; ++c)
+                adj[writePos[triangleIndices_[t * 3 + c]]++] = static_cast<uint32_t>(t);
+    }
+
+    std::vector<uint32_t> timestamp(numVerts, 0);
+    std::vector<bool>     emitted(numTris, false);
+    std::vector<uint32_t> deadEnd;
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> out;
+    out.reserve(triangleIndices_.size());
+
+    uint32_t time   = kCacheSize + 1;
+    uint32_t cursor = 0;
+    uint32_t fan    = 0;
+
+    while (fan != Subdiv::Control::INVALID_INDEX)
+    {
+        candidates.clear();
+
+        // Emit all live triangles around the fanning vertex
+        for (uint32_t a = adjOffsets[fan]; a < adjOffsets[fan + 1]; ++a)
+        {
+            uint32_t t = adj[a];
+            if (emitted[t]) continue;
+            emitted[t] = true;
+
+            for (size_t c = 0; c < 3; ++c)
+            {
+                uint32_t v = triangleIndices_[t * 3 + c];
+                out.push_back(v);
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                liveTris[v]--;
+                if (time - timestamp[v] > kCacheSize)
+                    timestamp[v] = time++;
+            }
+        }
+
+        // Next fanning vertex: the candidate that stays cached the longest
+        // after its remaining triangles are emitted
+        uint32_t next = Subdiv::Control::INVALID_INDEX;
+        int32_t  bestPriority = -1;
+        for (uint32_t v : candidates)
+        {
+            if (liveTris[v] == 0) continue;
+            int32_t priority = 0;
+            if (time - timestamp[v] + 2 * liveTris[v] <= kCacheSize)
+                priority = static_cast<int32_t>(time - timestamp[v]);
+            if (priority > bestPriority)
+            {
+                bestPriority = priority;
+                next = v;
+            }
+        }
+
+        // Dead-end: backtrack through recently used vertices, then scan
+        if (next == Subdiv::Control::INVALID_INDEX)
+        {
+            while (!deadEnd.empty())
+            {
+                uint32_t v = deadEnd.back();
+                deadEnd.pop_back();
+                if (liveTris[v] > 0) { next = v; break; }
+            }
+            if (next == Subdiv::Control::INVALID_INDEX)
+            {
+                while (cursor < numVerts)
+                {
+                    if (liveTris[cursor] > 0) { next = cursor; break; }
+                    cursor++;
+                }
+            }
+        }
+
+        fan = next;
+    }
+
+    triangleIndices_.swap(out);
+}
+
+void RenderMesh::compressIndices()
+{
+    // 16-bit indices halve IBO size and index-fetch bandwidth
+    if (mesh_.numVertices() > 0xFFFF) return;
+
+    triangleIndices16_.assign(triangleIndices_.begin(), triangleIndices_.end());
+    wireframeIndices16_.assign(wireframeIndices_.begin(), wireframeIndices_.end());
+    shortIndices_ = true;
+}
+
 size_t RenderMesh::getMemoryUsage() const
 {
     return triangleIndices_.size() * sizeof(uint32_t) +
-           wireframeIndices_.size() * sizeof(uint32_t);
+           wireframeIndices_.size() * sizeof(uint32_t) +
+           triangleIndices16_.size() * sizeof(uint16_t) +
+           wireframeIndices16_.size() * sizeof(uint16_t);
 }
@@ -34,19 +34,19 @@
 #endif
 
 // Forward declare Diagnostics namespace for macros
-// The actual class definition is in diagnosticscontext.h
-namespace Subdiv { class Context; class ScopedTimer; }
+// The actual class definition is in diagnostics/context.hpp
+namespace Subdiv::Diagnostics { class Context; class ScopedTimer; }
 
 // Profiling macros (now uses global singleton)
 #if SUBDIV_PROFILING_ENABLED
     #define SUBDIV_PROFILE(name) \
-        ::Subdiv::ScopedTimer _subdiv_timer_##__LINE__((name))
+        ::Subdiv::Diagnostics::ScopedTimer _subdiv_timer_##__LINE__((name))
     
     #define SUBDIV_PROFILE_FUNCTION() \
-        ::Subdiv::ScopedTimer _subdiv_timer_##__LINE__(__FUNCTION__)
+        ::Subdiv::Diagnostics::ScopedTimer _subdiv_timer_##__LINE__(__FUNCTION__)
     
     #define SUBDIV_PROFILE_SCOPE(name) \
-        ::Subdiv::ScopedTimer _subdiv_timer_##__LINE__((name))
+        ::Subdiv::Diagnostics::ScopedTimer _subdiv_timer_##__LINE__((name))
 #else
     #define SUBDIV_PROFILE(name) ((void)0)
     #define SUBDIV_PROFILE_FUNCTION() ((void)0)
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "mesh_types.hpp"
+
+#include <vector>
+
+namespace Subdiv::Control
+{
+
+/**
+ * @brief Flat open-addressing hash map from packed directed-edge keys to
+ *        half-edge indices.
+ *
+ * Purpose-built replacement for std::unordered_map<uint64_t, HalfEdgeIndex>
+ * in the mesh construction path:
+ * - Contiguous slot array (no per-insert node allocation)
+ * - Linear probing over a power-of-two table (one cache line per probe)
+ * - No erase support needed - the mesh only inserts and clears wholesale
+ *
+ * Keys are (v0 << 32) | v1 with both vertices valid indices, so the all-ones
+ * pattern can never occur and serves as the empty-slot sentinel.
+ */
+class DirectedEdgeMap
+{
+public:
+    DirectedEdgeMap() = default;
+
+    /**
+     * @brief Look up a directed edge key.
+     * @return Mapped half-edge index, or INVALID_INDEX if absent.
+     */
+    HalfEdgeIndex find(uint64_t key) const
+    {
+        if (slots_.empty()) return INVALID_INDEX;
+
+        size_t i = hash(key) & mask_;
+        while (slots_[i].key != kEmptyKey)
+        {
+            if (slots_[i].key == key)
+                return slots_[i].value;
+            i = (i + 1) & mask_;
+        }
+        return INVALID_INDEX;
+    }
+
+    bool contains(uint64_t key) const { return find(key) != INVALID_INDEX; }
+
+    /**
+     * @brief Insert or overwrite a key -> half-edge mapping.
+     */
+    void insert(uint64_t key, HalfEdgeIndex value)
+    {
+        if (slots_.empty() || (size_ + 1) * 4 > slots_.size() * 3) // load factor 0.75
+            grow();
+
+        size_t i = hash(key) & mask_;
+        while (slots_[i].key != kEmptyKey)
+        {
+            if (slots_[i].key == key)
+            {
+                slots_[i].value = value;
+                return;
+            }
+            i = (i + 1) & mask_;
+        }
+
+        slots_[i].key   = key;
+        slots_[i].value = value;
+        size_++;
+    }
+
+    /**
+     * @brief Pre-size the table for an expected number of entries.
+     */
+    void reserve(size_t count)
+    {
+        size_t capacity = kMinCapacity;
+        while (capacity * 3 < count * 4) // keep load factor below 0.75
+            capacity <<= 1;
+        if (capacity > slots_.size())
+            rehash(capacity);
+    }
+
+    void clear()
+    {
+        slots_.clear();
+        mask_ = 0;
+        size_ = 0;
+    }
+
+    size_t size() const { return size_; }
+
+    size_t memoryUsage() const { return slots_.size() * sizeof(Slot); }
+
+private:
+    static constexpr uint64_t kEmptyKey    = ~0ull;
+    static constexpr size_t   kMinCapacity = 16;
+
+    struct Slot
+    {
+        uint64_t      key   = kEmptyKey;
+        HalfEdgeIndex value = INVALID_INDEX;
+    };
+
+    // splitmix64 finalizer - strong enough to decorrelate packed vertex pairs
+    static uint64_t hash(uint64_t key)
+    {
+        key ^= key >> 30; key *= 0xbf58476d1ce4e5b9ull;
+        key ^= key >> 27; key *= 0x94d049bb133111ebull;
+        key ^= key >> 31;
+        return key;
+    }
+
+    void grow() { rehash(slots_.empty() ? kMinCapacity : slots_.size() * 2); }
+
+    void rehash(size_t capacity)
+    {
+        std::vector<Slot> old = std::move(slots_);
+        slots_.assign(capacity, Slot{});
+        mask_ = capacity - 1;
+
+        for (const Slot& slot : old)
+        {
+            if (slot.key == kEmptyKey) continue;
+            size_t i = hash(slot.key) & mask_;
+            while (slots_[i].key != kEmptyKey)
+                i = (i + 1) & mask_;
+            slots_[i] = slot;
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_t            mask_ = 0;
+    size_t            size_ = 0;
+};
+
+} // namespace Subdiv::Control
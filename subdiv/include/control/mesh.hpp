@@ -1,8 +1,7 @@
 #pragma once
 
 #include "mesh_cache.hpp"
-
-#include <unordered_map>
+#include "edge_map.hpp"
 
 namespace Subdiv::Control 
 {
@@ -27,9 +26,43 @@ public:
     ~Mesh() { clear(); }
 
     VertexIndex addVertex(const glm::vec3& pos);
-    FaceIndex   addFace(std::initializer_list<VertexIndex> verts); 
+    FaceIndex   addFace(std::initializer_list<VertexIndex> verts);
     FaceIndex   addFace(std::span<const VertexIndex> verts);
 
+    /// Quad convenience overload - no caller-side container needed.
+    FaceIndex addQuad(VertexIndex a, VertexIndex b, VertexIndex c, VertexIndex d)
+    {
+        const VertexIndex verts[4] = {a, b, c, d};
+        return addFace(std::span<const VertexIndex>(verts, 4));
+    }
+
+    /**
+     * @brief Add a regular n-gon in the XY plane (new vertices + one face).
+     * Uses the angle-sum recurrence - one sin/cos total, two muladds per
+     * vertex - instead of calling sin/cos per vertex.
+     * @return The new face, or INVALID_INDEX if n < 3.
+     */
+    FaceIndex addRegularPolygon(uint32_t n, float radius = 1.0f, const glm::vec3& center = {0.0f, 0.0f, 0.0f});
+
+    /**
+     * @brief Add many faces at once from a flat index buffer.
+     *
+     * Face i spans flatVerts[offsets[i]..offsets[i+1]) - offsets has one
+     * trailing sentinel, like the CSR arrays in TopologyCache. Reserves
+     * exact capacity up front. Faces that fail validation are skipped
+     * (errors are reported per face, construction continues).
+     *
+     * @return Number of faces successfully added.
+     */
+    size_t addFaces(std::span<const VertexIndex> flatVerts, std::span<const uint32_t> offsets);
+
+    /**
+     * @brief Pre-size all topology and attribute arrays.
+     * Call before bulk addVertex/addFace to avoid vector reallocations
+     * (numHalfEdges is the sum of face valences, ~4 * numFaces for quads).
+     */
+    void reserve(size_t numVerts, size_t numHalfEdges, size_t numFaces);
+
     void setPosition(VertexIndex v, const glm::vec3& pos);
     void setEdgeSharpness(EdgeIndex e, float sharpness);
     void setEdgeCrease(EdgeIndex e, bool crease);
@@ -89,8 +122,17 @@ public:
     size_t      getOneRingOffsetsBytes() const { return cache.getOneRingOffsets().size() * sizeof(uint32_t); }
 
 private:
-    std::unordered_map<uint64_t, HalfEdgeIndex> halfEdgeMap_;
-    
+    DirectedEdgeMap halfEdgeMap_;
+
+    // Duplicate-vertex scratch for addFace (generation counter avoids clearing)
+    std::vector<uint32_t> vertexSeenGen_;
+    uint32_t              vertexSeenGenCounter_ = 0;
+
+    // Twin lookups resolved during addFace pre-validation, reused by the
+    // creation loop so each directed edge probes the map once
+    std::vector<HalfEdgeIndex> twinScratch_;
+
+
     void invalidateCache() { cache.clear(); }
     
     static uint64_t makeDirectedEdgeKey(VertexIndex v0, VertexIndex v1) { return (static_cast<uint64_t>(v0) << 32) | v1; }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "mesh_types.hpp"
+#include "config.hpp"
 
 #include <span>
 #include <array>
@@ -67,11 +68,30 @@ public:
      */
     uint16_t getValence(VertexIndex v) const { return (v < valences_.size()) ? valences_[v] : 0; }
 
+    /**
+     * @brief Get vertex valence without a range check.
+     * For validated indices in inner loops - asserts in debug builds only.
+     */
+    uint16_t getValenceUnchecked(VertexIndex v) const noexcept
+    {
+        SUBDIV_ASSERT(v < valences_.size(), "Vertex index out of range");
+        return valences_[v];
+    }
+
     /**
      * @brief Check if vertex is on boundary.
      */
     bool isBoundaryVertex(VertexIndex v) const { return (v < boundaryFlags_.size()) ? boundaryFlags_[v] : false; }
 
+    /**
+     * @brief Boundary test without a range check (see getValenceUnchecked).
+     */
+    bool isBoundaryVertexUnchecked(VertexIndex v) const noexcept
+    {
+        SUBDIV_ASSERT(v < boundaryFlags_.size(), "Vertex index out of range");
+        return boundaryFlags_[v] != 0;
+    }
+
     /**
      * @brief Get vertex one-ring (neighboring vertices in CCW order).
      * 
@@ -97,6 +117,15 @@ public:
      */
     bool isBoundaryEdge(EdgeIndex e) const {  return (e < edgeBoundaryFlags_.size()) ? edgeBoundaryFlags_[e] : false; }
 
+    /**
+     * @brief Boundary test without a range check (see getValenceUnchecked).
+     */
+    bool isBoundaryEdgeUnchecked(EdgeIndex e) const noexcept
+    {
+        SUBDIV_ASSERT(e < edgeBoundaryFlags_.size(), "Edge index out of range");
+        return edgeBoundaryFlags_[e] != 0;
+    }
+
     /**
      * @brief Get edge vertices in canonical order (v0 < v1).
      * 
@@ -177,10 +206,18 @@ private:
     std::vector<VertexIndex> faceVertices_;    // Vertices of each face (CCW)
     std::vector<uint32_t>    faceVertexOffsets_; // Start index per face (+1 sentinel)
     
-    // Face edges (CSR format)
+    // Face edges (CSR format, shares faceVertexOffsets_ - both arrays
+    // hold exactly valence entries per face)
     std::vector<EdgeIndex> faceEdges_;         // Edges of each face (CCW)
-    std::vector<uint32_t>  faceEdgeOffsets_;   // Start index per face (+1 sentinel)    
     
+    // Build scratch - retained across builds so repeated build() calls
+    // reuse warm capacity instead of reallocating (values are reset each
+    // build; the stamp buffer is epoch-invalidated, see build())
+    std::vector<uint32_t> edgeFaceCounts_;
+    std::vector<uint32_t> vertexFaceCounts_;
+    std::vector<uint32_t> visitedStamp_;
+    uint32_t              visitedEpoch_ = 0;
+
     // Statistics
     uint64_t numBoundaryVertices_ = 0;
     uint64_t numBoundaryEdges_    = 0;
@@ -3,8 +3,10 @@
 #include "config.hpp"
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <optional>
+#include <atomic>
 #include <chrono>
 #include <unordered_map>
 #include <memory>
@@ -36,6 +38,17 @@ struct ErrorInfo
         : severity(sev), code(c), message(msg), context(ctx) {}
 };
 
+/**
+ * @brief Transparent string hashing - lets the diagnostic maps be probed
+ * with a string_view or const char* without materializing a std::string
+ * per lookup (profiled call sites pass static names every sample).
+ */
+struct StringHash
+{
+    using is_transparent = void;
+    size_t operator()(std::string_view sv) const { return std::hash<std::string_view>{}(sv); }
+};
+
 /**
  * @brief Timing information for a profiled operation.
  */
@@ -92,11 +105,11 @@ class ScopedTimer
 public:
 
 #if SUBDIV_PROFILING_ENABLED
-    ScopedTimer(const std::string& name);
+    ScopedTimer(const char* name);
     ~ScopedTimer();
 #else
     // No-op in non-profiling builds
-    ScopedTimer(const std::string&) {}
+    ScopedTimer(const char*) {}
     ~ScopedTimer() {}
 #endif
     
@@ -107,7 +120,7 @@ public:
 private:
 
 #if SUBDIV_PROFILING_ENABLED
-    std::string m_name;
+    const char* m_name;  // Static call-site name, no copy
     std::chrono::high_resolution_clock::time_point m_start;
 #endif
 };
@@ -165,30 +178,34 @@ public:
     
      // --- Profiling ---
 #if SUBDIV_PROFILING_ENABLED
-    static void startTimer(const std::string& name);
-    static void stopTimer(const std::string& name);
-    static void recordTiming(const std::string& name, double durationMs);
+    using TimingMap = std::unordered_map<std::string, TimingInfo, StringHash, std::equal_to<>>;
+
+    static void startTimer(std::string_view name);
+    static void stopTimer(std::string_view name);
+    static void recordTiming(std::string_view name, double durationMs);
     
-    static const std::unordered_map<std::string, TimingInfo>& getTimings();
+    static const TimingMap& getTimings();
     static std::string getProfilingSummary();
 #else
-    static void startTimer(const std::string&) {}
-    static void stopTimer(const std::string&) {}
-    static void recordTiming(const std::string&, double) {}
+    static void startTimer(std::string_view) {}
+    static void stopTimer(std::string_view) {}
+    static void recordTiming(std::string_view, double) {}
     
     static std::string getProfilingSummary() { return "Profiling disabled"; }
 #endif
     
     // --- Memory tracking ---
 #if SUBDIV_MEMORY_TRACKING_ENABLED
-    static void recordAllocation(const std::string& category, size_t bytes);
-    static void recordDeallocation(const std::string& category, size_t bytes);
-    
-    static const std::unordered_map<std::string, MemoryInfo>& getMemoryInfo();
+    using MemoryMap = std::unordered_map<std::string, MemoryInfo, StringHash, std::equal_to<>>;
+
+    static void recordAllocation(std::string_view category, size_t bytes);
+    static void recordDeallocation(std::string_view category, size_t bytes);
+
+    static const MemoryMap& getMemoryInfo();
     static std::string getMemorySummary();
 #else
-    static void recordAllocation(const std::string&, size_t) {}
-    static void recordDeallocation(const std::string&, size_t) {}
+    static void recordAllocation(std::string_view, size_t) {}
+    static void recordDeallocation(std::string_view, size_t) {}
     
     static std::string getMemorySummary() { return "Memory tracking disabled"; }
 #endif
@@ -210,21 +227,31 @@ private:
     Context() : m_mode(Mode::DISABLED) {}
     ~Context() = default;
     
-    Mode m_mode;
-    std::mutex m_mutex;  // Thread safety
+    // Atomic so the mode check on instrumented hot paths (SUBDIV_ADD_ERROR,
+    // ScopedTimer) is a single relaxed load instead of a mutex acquire.
+    std::atomic<Mode> m_mode;
+
+    // Per-severity tallies kept alongside m_errors so the hasErrors/
+    // hasWarnings/hasFatalErrors predicates are O(1) relaxed loads
+    // instead of locked scans of the error vector.
+    std::atomic<uint32_t> m_errorCount{0};    // All severities
+    std::atomic<uint32_t> m_warningCount{0};
+    std::atomic<uint32_t> m_fatalCount{0};
+
+    std::mutex m_mutex;  // Guards the containers below
     
     // Error tracking
     std::vector<ErrorInfo> m_errors;
     
     // Profiling
 #if SUBDIV_PROFILING_ENABLED
-    std::unordered_map<std::string, TimingInfo> m_timings;
-    std::unordered_map<std::string, std::chrono::high_resolution_clock::time_point> m_activeTimers;
+    TimingMap m_timings;
+    std::unordered_map<std::string, std::chrono::high_resolution_clock::time_point, StringHash, std::equal_to<>> m_activeTimers;
 #endif
     
     // Memory tracking
 #if SUBDIV_MEMORY_TRACKING_ENABLED
-    std::unordered_map<std::string, MemoryInfo> m_memoryTracking;
+    MemoryMap m_memoryTracking;
 #endif
 };
 
@@ -1,8 +1,10 @@
 #include "control/mesh.hpp"
 #include "diagnostics/context.hpp"
 
-#include <unordered_set>
+#include <glm/gtc/constants.hpp>
+
 #include <algorithm>
+#include <cmath>
 
 namespace Subdiv::Control
 {
@@ -27,9 +29,84 @@ VertexIndex Mesh::addVertex(const glm::vec3& pos)
     return idx;
 }
 
-FaceIndex Mesh::addFace(std::initializer_list<VertexIndex> verts) 
-{ 
-    return addFace(std::span<const VertexIndex>(verts)); 
+FaceIndex Mesh::addFace(std::initializer_list<VertexIndex> verts)
+{
+    return addFace(std::span<const VertexIndex>(verts));
+}
+
+FaceIndex Mesh::addRegularPolygon(uint32_t n, float radius, const glm::vec3& center)
+{
+    if (n < 3)
+    {
+        SUBDIV_ADD_ERROR(Subdiv::Diagnostics::ErrorSeverity::ERROR,"FACE_TOO_FEW_VERTICES", "Regular polygon needs at least 3 vertices", "Got " + std::to_string(n));
+        return INVALID_INDEX;
+    }
+
+    reserve(vertices.size() + n, halfEdges.size() + n, faces.size() + 1);
+
+    // Angle-sum recurrence: (cos(a+d), sin(a+d)) from (cos a, sin a) with
+    // two muladds - one sin/cos evaluation for the whole ring
+    const float stepCos = std::cos(glm::two_pi<float>() / static_cast<float>(n));
+    const float stepSin = std::sin(glm::two_pi<float>() / static_cast<float>(n));
+
+    float c = 1.0f;
+    float s = 0.0f;
+
+    std::vector<VertexIndex> ring(n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        ring[i] = addVertex({center.x + radius * c, center.y + radius * s, center.z});
+
+        const float cNext = c * stepCos - s * stepSin;
+        s = s * stepCos + c * stepSin;
+        c = cNext;
+    }
+
+    return addFace(std::span<const VertexIndex>(ring));
+}
+
+size_t Mesh::addFaces(std::span<const VertexIndex> flatVerts, std::span<const uint32_t> offsets)
+{
+    SUBDIV_PROFILE_FUNCTION();
+
+    if (offsets.size() < 2) return 0;
+
+    const size_t numFaces = offsets.size() - 1;
+
+    // One exact reservation covers the whole batch
+    reserve(vertices.size(), halfEdges.size() + flatVerts.size(), faces.size() + numFaces);
+
+    size_t added = 0;
+    for (size_t f = 0; f < numFaces; ++f)
+    {
+        const uint32_t begin = offsets[f];
+        const uint32_t end   = offsets[f + 1];
+
+        if (begin > end || end > flatVerts.size())
+        {
+            SUBDIV_ADD_ERROR(Subdiv::Diagnostics::ErrorSeverity::ERROR,"INVALID_FACE_OFFSETS", "Face offset range out of bounds", "Face " + std::to_string(f));
+            continue;
+        }
+
+        if (addFace(flatVerts.subspan(begin, end - begin)) != INVALID_INDEX)
+            ++added;
+    }
+
+    return added;
+}
+
+void Mesh::reserve(size_t numVerts, size_t numHalfEdges, size_t numFaces)
+{
+    vertices.reserve(numVerts);
+    positions.reserve(numVerts);
+    normals.reserve(numVerts);
+    uvs.reserve(numVerts);
+
+    halfEdges.reserve(numHalfEdges);
+    edges.reserve(numHalfEdges / 2 + 1); // Every edge has at most 2 half-edges
+    faces.reserve(numFaces);
+
+    halfEdgeMap_.reserve(numHalfEdges);
 }
 
 FaceIndex Mesh::addFace(std::span<const VertexIndex> verts)
@@ -51,44 +128,55 @@ FaceIndex Mesh::addFace(std::span<const VertexIndex> verts)
         }
     }
 
-    // Check for duplicate vertices in face
-    std::unordered_set<VertexIndex> vertSet;
-    for (size_t i = 0; i < verts.size(); ++i) 
+    // Check for duplicate vertices in face - generation-counter scratch array,
+    // no per-call allocation or clearing (stale generations read as unseen)
+    if (vertexSeenGen_.size() < vertices.size())
+        vertexSeenGen_.resize(vertices.size(), 0);
+    if (++vertexSeenGenCounter_ == 0) // Counter wrapped - reset stale marks
+    {
+        std::fill(vertexSeenGen_.begin(), vertexSeenGen_.end(), 0);
+        vertexSeenGenCounter_ = 1;
+    }
+    for (size_t i = 0; i < verts.size(); ++i)
     {
-        if (!vertSet.insert(verts[i]).second) 
+        if (vertexSeenGen_[verts[i]] == vertexSeenGenCounter_)
         {
             SUBDIV_ADD_ERROR(Subdiv::Diagnostics::ErrorSeverity::ERROR,"DUPLICATE_VERTEX_IN_FACE", "Face contains duplicate vertex", "Vertex " + std::to_string(verts[i]) + " appears multiple times");
             return INVALID_INDEX;
         }
+        vertexSeenGen_[verts[i]] = vertexSeenGenCounter_;
     }
 
-    // Check for duplicate directed edges and non-manifold edges
-    for (size_t i = 0; i < verts.size(); ++i) 
+    // Check for duplicate directed edges and non-manifold edges. Twin lookups
+    // are kept for the creation loop below - one map probe per directed edge.
+    const size_t numVerts = verts.size();
+    twinScratch_.assign(numVerts, INVALID_INDEX);
+    for (size_t i = 0, iNext = 1; i < numVerts; ++i, iNext = (iNext + 1 == numVerts) ? 0 : iNext + 1)
     {
         VertexIndex v0 = verts[i];
-        VertexIndex v1 = verts[(i + 1) % verts.size()];
+        VertexIndex v1 = verts[iNext];
 
         uint64_t key     = makeDirectedEdgeKey(v0, v1);
         uint64_t twinKey = makeDirectedEdgeKey(v1, v0);
-        
+
         // Check if this directed edge already exists
-        if (halfEdgeMap_.find(key) != halfEdgeMap_.end()) 
+        if (halfEdgeMap_.contains(key))
         {
             SUBDIV_ADD_ERROR(Subdiv::Diagnostics::ErrorSeverity::ERROR,"NON_MANIFOLD_EDGE", "Directed edge already exists", "Edge " + std::to_string(v0) + "->" + std::to_string(v1) + " at position " + std::to_string(i));
             return INVALID_INDEX;
         }
 
         // Check if twin edge exists and already has a twin (non-manifold)
-        auto twinIt = halfEdgeMap_.find(twinKey);
-        if (twinIt != halfEdgeMap_.end()) 
+        HalfEdgeIndex twinHe = halfEdgeMap_.find(twinKey);
+        if (twinHe != INVALID_INDEX)
         {
-            HalfEdgeIndex twinHe = twinIt->second;
-            if (halfEdges[twinHe].twin != INVALID_INDEX) 
+            if (halfEdges[twinHe].twin != INVALID_INDEX)
             {
                 SUBDIV_ADD_ERROR(Subdiv::Diagnostics::ErrorSeverity::ERROR,"NON_MANIFOLD_EDGE", "Edge would have more than 2 faces", "Edge " + std::to_string(v0) + "->" +  std::to_string(v1));
                 return INVALID_INDEX;
             }
         }
+        twinScratch_[i] = twinHe;
     }
 
     // Create Face ============================================================
@@ -105,29 +193,28 @@ FaceIndex Mesh::addFace(std::span<const VertexIndex> verts)
 
     HalfEdgeIndex firstHe = static_cast<HalfEdgeIndex>(halfEdges.size());
 
-    for(size_t i=0; i < verts.size(); ++i)
+    for (size_t i = 0, iNext = 1; i < numVerts; ++i, iNext = (iNext + 1 == numVerts) ? 0 : iNext + 1)
     {
         VertexIndex v0 = verts[i];
-        VertexIndex v1 = verts[(i + 1) % verts.size()];
+        VertexIndex v1 = verts[iNext];
 
         HalfEdgeIndex heIdx = static_cast<HalfEdgeIndex>(halfEdges.size());
 
         HalfEdge he;
         he.to = v1;
         he.face = faceIdx;
-        he.next = (i + 1 < verts.size()) ? heIdx + 1 : firstHe;
-        he.prev = (i > 0) ? heIdx - 1 : firstHe + static_cast<HalfEdgeIndex>(verts.size() - 1);
+        he.next = (i + 1 < numVerts) ? heIdx + 1 : firstHe;
+        he.prev = (i > 0) ? heIdx - 1 : firstHe + static_cast<HalfEdgeIndex>(numVerts - 1);
         he.twin = INVALID_INDEX;
         he.edge = INVALID_INDEX;
 
-        // Check if twin exists
-        uint64_t twinKey = makeDirectedEdgeKey(v1, v0);
-        auto twinIt = halfEdgeMap_.find(twinKey);
+        // Twin already resolved during pre-validation (a face never contains
+        // both directions of an edge, so the result cannot go stale mid-loop)
+        HalfEdgeIndex twinIdx = twinScratch_[i];
 
-        if (twinIt != halfEdgeMap_.end()) 
+        if (twinIdx != INVALID_INDEX)
         {
             // Twin exists - link them and reuse edge
-            HalfEdgeIndex twinIdx = twinIt->second;
 
             // Ensure twin doesn't already have a twin
             if (halfEdges[twinIdx].twin != INVALID_INDEX) 
@@ -163,7 +250,7 @@ FaceIndex Mesh::addFace(std::span<const VertexIndex> verts)
 
         // Add to map
         uint64_t directedKey = makeDirectedEdgeKey(v0, v1);
-        halfEdgeMap_[directedKey] = heIdx;
+        halfEdgeMap_.insert(directedKey, heIdx);
         
         // Update vertex outgoing
         if (vertices[v0].outgoing == INVALID_INDEX)
@@ -206,6 +293,9 @@ void Mesh::clear()
     normals.clear();
     uvs.clear();
     halfEdgeMap_.clear();
+    vertexSeenGen_.clear();
+    vertexSeenGenCounter_ = 0;
+    twinScratch_.clear();
     cache.clear();
 }
 
@@ -241,20 +331,11 @@ std::array<VertexIndex, 2> Mesh::getEdgeVertices(EdgeIndex e) const
 
 HalfEdgeIndex Mesh::findHalfEdge(VertexIndex v0, VertexIndex v1) const
 {
-    uint64_t key = makeDirectedEdgeKey(v0, v1);
-    auto it = halfEdgeMap_.find(key);
-    
-    if (it != halfEdgeMap_.end())
-        return it->second;
-    
-    // Try twin direction and return twin
-    uint64_t twinKey = makeDirectedEdgeKey(v1, v0);
-    it = halfEdgeMap_.find(twinKey);
-    
-    if (it != halfEdgeMap_.end())
-        return halfEdges[it->second].twin;
-    
-    return INVALID_INDEX;
+    // One probe suffices: addFace inserts every created half-edge under its
+    // own directed key, so if v0->v1 exists the forward lookup finds it. The
+    // old twin-direction fallback could only find a half-edge whose twin was
+    // still INVALID_INDEX - dead code, removed.
+    return halfEdgeMap_.find(makeDirectedEdgeKey(v0, v1));
 }
 
 EdgeIndex Mesh::findEdge(VertexIndex v0, VertexIndex v1) const
@@ -297,31 +378,35 @@ void Mesh::computeNormals()
         
         if (face.valence < 3) continue;
         
+        if (face.edge == INVALID_INDEX || face.edge >= halfEdges.size()) continue;
+
+        // Newell's method: sum edge contributions around the whole loop.
+        // Robust for non-planar ngons (unlike a first-three-vertices cross
+        // product) and the magnitude stays 2x face area, so accumulating
+        // the raw normal keeps the area weighting.
+        glm::vec3 normal(0.0f);
         HalfEdgeIndex he = face.edge;
-        if (he == INVALID_INDEX || he >= halfEdges.size()) continue;
-        
-        // Get first 3 vertices to compute normal
-        VertexIndex v0 = getFromVertex(he);
-        he = halfEdges[he].next;
-        if (he == INVALID_INDEX || he >= halfEdges.size()) continue;
-        
-        VertexIndex v1 = getFromVertex(he);
-        he = halfEdges[he].next;
-        if (he == INVALID_INDEX || he >= halfEdges.size()) continue;
-        
-        VertexIndex v2 = getFromVertex(he);
-        
-        if (v0 >= positions.size() || v1 >= positions.size() || v2 >= positions.size()) continue;
-        
-        glm::vec3 p0 = positions[v0];
-        glm::vec3 p1 = positions[v1];
-        glm::vec3 p2 = positions[v2];
-        
-        glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
-        
+        size_t count = 0;
+        do
+        {
+            VertexIndex vi = getFromVertex(he);
+            VertexIndex vn = halfEdges[he].to;
+            if (vi < positions.size() && vn < positions.size())
+            {
+                const glm::vec3& pi = positions[vi];
+                const glm::vec3& pn = positions[vn];
+                normal.x += (pi.y - pn.y) * (pi.z + pn.z);
+                normal.y += (pi.z - pn.z) * (pi.x + pn.x);
+                normal.z += (pi.x - pn.x) * (pi.y + pn.y);
+            }
+            he = halfEdges[he].next;
+            count++;
+        }
+        while (he != face.edge && he != INVALID_INDEX && count < face.valence + 10);
+
         // Accumulate to all face vertices
         he = face.edge;
-        size_t count = 0;
+        count = 0;
         do 
         {
             VertexIndex v = getFromVertex(he);
@@ -455,7 +540,7 @@ size_t Mesh::getMemoryUsage() const
     total += cache.memoryUsage();
     
     // Half-edge map overhead
-    total += halfEdgeMap_.size() * (sizeof(uint64_t) + sizeof(HalfEdgeIndex));
+    total += halfEdgeMap_.memoryUsage();
     
     return total;
 }
@@ -27,29 +27,39 @@ void TopologyCache::build(const Mesh& mesh)
     
     // PHASE 1: Build edge data (single pass over half-edges) =================
     
-    std::vector<uint32_t> edgeFaceCounts(numEdges, 0);
+    edgeFaceCounts_.assign(numEdges, 0);
+    vertexFaceCounts_.assign(numVerts, 0);
 
     // Single pass over half-edges
     for(HalfEdgeIndex h = 0; h < mesh.halfEdges.size(); ++h)
     {
         const HalfEdge& he = mesh.halfEdges[h];
 
+        // Vertex-face incidence count (was a separate Phase 4 pass): every
+        // half-edge with a face contributes exactly one (vertex, face) pair
+        if(he.face != INVALID_INDEX)
+        {
+            const VertexIndex v = mesh.getFromVertex(h);
+            if (isValidIndex(v, numVerts))
+                vertexFaceCounts_[v]++;
+        }
+
         if(he.edge == INVALID_INDEX || he.edge >= numEdges) continue;
 
         // Set edge vertices
         if(edgeVertices_[he.edge][0] == INVALID_INDEX)
         {
-            VertexIndex v0 = mesh.getFromVertex(h);
-            VertexIndex v1 = he.to;
+            const VertexIndex v0 = mesh.getFromVertex(h);
+            const VertexIndex v1 = he.to;
 
-            // Store in canonical order (v0 < v1)
-            if(v0 > v1) std::swap(v0, v1);
-            edgeVertices_[he.edge] = {v0, v1};
+            // Store in canonical order (v0 < v1) - min/max compile to cmov,
+            // avoiding a data-dependent branch in this per-half-edge loop
+            edgeVertices_[he.edge] = {std::min(v0, v1), std::max(v0, v1)};
         }
 
         // Count adjacent faces
         if(he.face != INVALID_INDEX)
-            edgeFaceCounts[he.edge]++;
+            edgeFaceCounts_[he.edge]++;
         
         // If he has twin, then it is not boundary
         if(he.twin != INVALID_INDEX)
@@ -59,8 +69,8 @@ void TopologyCache::build(const Mesh& mesh)
 #if SUBDIV_ENABLE_PROFILING
     // Detect non-manifold edges
     for (EdgeIndex e = 0; e < numEdges; ++e) {
-        if (edgeFaceCounts[e] > 2)
-            SUBDIV_ADD_ERROR(Subdiv::Diagnostics::ErrorSeverity::WARNING,"NON_MANIFOLD_EDGE_DETECTED", "Edge has more than 2 faces", "Edge " + std::to_string(e) + " has " + std::to_string(edgeFaceCounts[e]) + " faces");
+        if (edgeFaceCounts_[e] > 2)
+            SUBDIV_ADD_ERROR(Subdiv::Diagnostics::ErrorSeverity::WARNING,"NON_MANIFOLD_EDGE_DETECTED", "Edge has more than 2 faces", "Edge " + std::to_string(e) + " has " + std::to_string(edgeFaceCounts_[e]) + " faces");
     }
 #endif
 
@@ -96,150 +106,145 @@ void TopologyCache::build(const Mesh& mesh)
     numBoundaryVertices_ = std::count(boundaryFlags_.begin(), boundaryFlags_.end(), 1);
 
     // PHASE 4: Count vertex-face incidence ===================================
-    
-    std::vector<uint32_t> vertexFaceCounts(numVerts, 0);
-    
-    // Count faces per vertex
-    for (FaceIndex f = 0; f < numFaces; ++f) 
-    {
-        const Face& face = mesh.faces[f];
-        
-        HalfEdgeIndex start = face.edge;
-        if (start == INVALID_INDEX) continue;
-        
-        HalfEdgeIndex current = start;
-        std::vector<bool> visited(numHalfEdges, false); // Stack-allocated for speed
-        
-        do 
-        {
-            if (visited[current]) 
-            {
-                SUBDIV_ADD_ERROR(Subdiv::Diagnostics::ErrorSeverity::WARNING, "CYCLE_IN_FACE", "Detected cycle in face loop", "Face " + std::to_string(f));
-                break;
-            }
 
-            visited[current] = true;
+    // Folded into the Phase 1 half-edge scan - vertexFaceCounts_ is filled
+    // there. Malformed face cycles are still caught by the guarded walk in
+    // Phase 8.
 
-            VertexIndex v = mesh.getFromVertex(current);
-            if (isValidIndex(v, numVerts))
-                vertexFaceCounts[v]++;
-            
-            current = mesh.halfEdges[current].next;
-        } 
-        while (current != start && isValidIndex(current, numHalfEdges));
-    }
-    
     // PHASE 5: Build CSR offsets =============================================
     
+    // The vertex/edge-indexed offset arrays are built shifted one slot:
+    // before the fill passes, offsets[i + 1] holds the START of row i and
+    // serves directly as that row's write cursor. A fully written row leaves
+    // offsets[i + 1] at its end - exactly the final CSR value - so no
+    // separate write-cursor copies and no restore pass are needed
+    // (offsets[0] stays 0 throughout).
+
     // Vertex one-ring offsets
-    oneRingOffsets_.resize(numVerts + 1, 0);
-    oneRingOffsets_[0] = 0;
+    oneRingOffsets_.assign(numVerts + 1, 0);
+    uint32_t oneRingTotal = 0;
     for (size_t v = 0; v < numVerts; ++v)
-        oneRingOffsets_[v + 1] = oneRingOffsets_[v] + static_cast<uint32_t>(valences_[v]);
-    
+    {
+        oneRingOffsets_[v + 1] = oneRingTotal;
+        oneRingTotal += valences_[v];
+    }
+
     // Vertex-face offsets
-    vertexFaceOffsets_.resize(numVerts + 1, 0);
-    vertexFaceOffsets_[0] = 0;
+    vertexFaceOffsets_.assign(numVerts + 1, 0);
+    uint32_t vertexFaceTotal = 0;
     for (size_t v = 0; v < numVerts; ++v)
-        vertexFaceOffsets_[v + 1] = vertexFaceOffsets_[v] + vertexFaceCounts[v];
-    
+    {
+        vertexFaceOffsets_[v + 1] = vertexFaceTotal;
+        vertexFaceTotal += vertexFaceCounts_[v];
+    }
+
     // Edge-face offsets
-    edgeFaceOffsets_[0] = 0;
+    uint32_t edgeFaceTotal = 0;
     for (size_t e = 0; e < numEdges; ++e)
-        edgeFaceOffsets_[e + 1] = edgeFaceOffsets_[e] + edgeFaceCounts[e];
-    
-    // Face-vertex offsets
+    {
+        edgeFaceOffsets_[e + 1] = edgeFaceTotal;
+        edgeFaceTotal += edgeFaceCounts_[e];
+    }
+
+    // Face offsets - faceVertices_ and faceEdges_ both hold valence entries
+    // per face, so one offset array serves both
     faceVertexOffsets_.resize(numFaces + 1, 0);
     faceVertexOffsets_[0] = 0;
     for (size_t f = 0; f < numFaces; ++f)
         faceVertexOffsets_[f + 1] = faceVertexOffsets_[f] + mesh.faces[f].valence;
-    
-    // Face-edge offsets
-    faceEdgeOffsets_.resize(numFaces + 1, 0);
-    faceEdgeOffsets_[0] = 0;
-    for (size_t f = 0; f < numFaces; ++f) 
-        faceEdgeOffsets_[f + 1] = faceEdgeOffsets_[f] + mesh.faces[f].valence;
 
     // PHASE 6: Allocate flattened arrays =====================================
     
-    oneRings_.resize(oneRingOffsets_.back());
-    vertexFaces_.resize(vertexFaceOffsets_.back());
-    edgeFaces_.resize(edgeFaceOffsets_.back());
+    oneRings_.resize(oneRingTotal);
+    vertexFaces_.resize(vertexFaceTotal);
+    edgeFaces_.resize(edgeFaceTotal);
     faceVertices_.resize(faceVertexOffsets_.back());
-    faceEdges_.resize(faceEdgeOffsets_.back());
+    faceEdges_.resize(faceVertexOffsets_.back());
 
     // PHASE 7: Fill vertex one-rings (ORDERED CCW, half-edge-based) ==========
 
-    std::vector<uint32_t> oneRingWritePos = oneRingOffsets_;
-    std::vector<bool>     visitedHalfEdges(numHalfEdges); // Reusable buffer
+    // Visited marks shared by the Phase 7/8 walks. Generation counter:
+    // bumping the epoch invalidates all marks at once, so there is no
+    // O(numHalfEdges) refill per vertex/face - same pattern as the
+    // duplicate-vertex scratch in Mesh::addFace. Stale marks from earlier
+    // builds carry older epochs and are harmless.
+    if (visitedStamp_.size() < numHalfEdges)
+        visitedStamp_.resize(numHalfEdges, 0);
+
+    // New epoch = all visited marks cleared
+    auto nextEpoch = [&]() {
+        if (++visitedEpoch_ == 0) // Counter wrapped - reset stale marks
+        {
+            std::fill(visitedStamp_.begin(), visitedStamp_.end(), 0);
+            visitedEpoch_ = 1;
+        }
+    };
 
     for (VertexIndex v = 0; v < numVerts; ++v)
     {
         const Vertex& vert = mesh.vertices[v];
         if (vert.outgoing == INVALID_INDEX) continue;
-        
-        //const uint32_t writeStart = oneRingWritePos[v];
-        const uint32_t writeEnd = oneRingOffsets_[v + 1];
-        
+
+        // oneRingOffsets_[v + 1] is this row's write cursor (see Phase 5)
+        const uint32_t writeEnd = oneRingOffsets_[v + 1] + valences_[v];
+
+        // Rewind counter-clockwise (prev->twin) so that for boundary
+        // vertices `start` is the first outgoing half-edge after the gap -
+        // then ONE forward sweep covers the whole ring in rotation order.
+        // Interior vertices cycle; the visited guard stops the rewind.
         HalfEdgeIndex start = vert.outgoing;
-        HalfEdgeIndex current = start;
+        nextEpoch();
+        while (true)
+        {
+            const HalfEdgeIndex prev = mesh.halfEdges[start].prev;
+            if (!isValidIndex(prev, numHalfEdges)) break;
 
-        // Clear visited flags for this vertex
-        std::fill(visitedHalfEdges.begin(), visitedHalfEdges.end(), false);
-        
-        // First, check if we're on a boundary by walking forward
-        // Walk clockwise (twin->next)
-        bool hitBoundary = false;
+            const HalfEdgeIndex prevTwin = mesh.halfEdges[prev].twin;
+            if (prevTwin == INVALID_INDEX) [[unlikely]] break; // start is now first after boundary
+
+            if (visitedStamp_[prevTwin] == visitedEpoch_) break; // Full cycle (interior)
+            visitedStamp_[prevTwin] = visitedEpoch_;
+
+            start = prevTwin;
+        }
+
+        // Forward sweep (twin->next), fresh epoch since the rewind marked
+        // the same half-edges
+        HalfEdgeIndex current = start;
+        nextEpoch();
         do {
-            if (visitedHalfEdges[current]) break; // Cycle detected
+            if (visitedStamp_[current] == visitedEpoch_) break; // Cycle detected
 
-            visitedHalfEdges[current] = true;
+            visitedStamp_[current] = visitedEpoch_;
             
             const VertexIndex neighbor = mesh.halfEdges[current].to;
-            if (oneRingWritePos[v] < writeEnd)
-                oneRings_[oneRingWritePos[v]++] = neighbor;
+            if (oneRingOffsets_[v + 1] < writeEnd)
+                oneRings_[oneRingOffsets_[v + 1]++] = neighbor;
             
             const HalfEdgeIndex twin = mesh.halfEdges[current].twin;
-            if (twin == INVALID_INDEX) 
+            // Taken at most once per ring (boundary exit) - keep the
+            // interior rotation as the fall-through path
+            if (twin == INVALID_INDEX) [[unlikely]]
             {
-                hitBoundary = true;
+                // Boundary: the incoming boundary half-edge at `start`
+                // contributes the one neighbor with no outgoing half-edge
+                const HalfEdgeIndex firstPrev = mesh.halfEdges[start].prev;
+                if (isValidIndex(firstPrev, numHalfEdges))
+                {
+                    const VertexIndex lastNeighbour = mesh.getFromVertex(firstPrev);
+                    if (oneRingOffsets_[v + 1] < writeEnd)
+                        oneRings_[oneRingOffsets_[v + 1]++] = lastNeighbour;
+                }
                 break;
             }
             
             current = mesh.halfEdges[twin].next;
             
         } while (current != start);
-        
-        // If boundary, walk BACKWARDS to find the first boundary half-edge
-        if (hitBoundary) 
-        {
-            while (true) 
-            {
-                const HalfEdgeIndex prev = mesh.halfEdges[current].prev;
-                if (!isValidIndex(prev, numHalfEdges)) break;
-                
-                const HalfEdgeIndex prevTwin = mesh.halfEdges[prev].twin;
-                if (prevTwin == INVALID_INDEX) 
-                {
-                    const VertexIndex lastNeighbour = mesh.getFromVertex(prev);
-                    if(oneRingWritePos[v] < writeEnd)
-                        oneRings_[oneRingWritePos[v]++] = lastNeighbour;
-                    break;
-                }
-                
-                if (visitedHalfEdges[prevTwin]) break; // Already processed
-                visitedHalfEdges[prevTwin] = true;
-
-                const VertexIndex neighbor = mesh.halfEdges[prevTwin].to;
-                if (oneRingWritePos[v] < writeEnd)
-                    oneRings_[oneRingWritePos[v]++] = neighbor;
-                current = prevTwin;
-            }
-        }
 
 #if SUBDIV_ENABLE_PROFILING
         // Verify count
-        const size_t written = oneRingWritePos[v] - writeStart;
+        const size_t written = oneRingOffsets_[v + 1] - (writeEnd - valences_[v]);
         if (written != valences_[v]) 
             SUBDIV_ADD_ERROR(Subdiv::Diagnostics::ErrorSeverity::WARNING, "ONE_RING_COUNT_MISMATCH", "One-ring doesn't match valence", "Vertex " + std::to_string(v) +  ": expected " + std::to_string(valences_[v]) + ", got " + std::to_string(written));
 #endif
@@ -247,10 +252,10 @@ void TopologyCache::build(const Mesh& mesh)
 
     // PHASE 8: Fill face data and incidence relationships ====================
     
-    std::vector<uint32_t> vertexFaceWritePos = vertexFaceOffsets_;
-    std::vector<uint32_t> edgeFaceWritePos = edgeFaceOffsets_;
-    
-    for (FaceIndex f = 0; f < numFaces; ++f) 
+    // vertexFaceOffsets_/edgeFaceOffsets_[i + 1] are the row cursors
+    // (see Phase 5); the count arrays double as remaining-capacity guards
+
+    for (FaceIndex f = 0; f < numFaces; ++f)
     {
         const Face& face = mesh.faces[f];
         
@@ -259,17 +264,17 @@ void TopologyCache::build(const Mesh& mesh)
         
         HalfEdgeIndex current = start;
         uint32_t faceVertPos = faceVertexOffsets_[f];
-        uint32_t faceEdgePos = faceEdgeOffsets_[f];
+        uint32_t faceEdgePos = faceVertexOffsets_[f];
 
         const uint32_t faceVertEnd = faceVertexOffsets_[f + 1];
-        const uint32_t faceEdgeEnd = faceEdgeOffsets_[f + 1];
+        const uint32_t faceEdgeEnd = faceVertEnd;
         
-        std::fill(visitedHalfEdges.begin(), visitedHalfEdges.end(), false);
+        nextEpoch();
 
-        do 
+        do
         {
-            if (visitedHalfEdges[current]) break;
-            visitedHalfEdges[current] = true;
+            if (visitedStamp_[current] == visitedEpoch_) break;
+            visitedStamp_[current] = visitedEpoch_;
 
             const HalfEdge& he = mesh.halfEdges[current];
             
@@ -281,8 +286,11 @@ void TopologyCache::build(const Mesh& mesh)
                     faceVertices_[faceVertPos++] = v;
                 
                 // Add face to vertex
-                if (vertexFaceWritePos[v] < vertexFaceOffsets_[v + 1]) 
-                    vertexFaces_[vertexFaceWritePos[v]++] = f;
+                if (vertexFaceCounts_[v] > 0)
+                {
+                    vertexFaces_[vertexFaceOffsets_[v + 1]++] = f;
+                    vertexFaceCounts_[v]--;
+                }
             }
             
             // Add edge to face
@@ -293,8 +301,11 @@ void TopologyCache::build(const Mesh& mesh)
                     faceEdges_[faceEdgePos++] = e;
                 
                 // Add face to edge
-                if (edgeFaceWritePos[e] < edgeFaceOffsets_[e + 1])
-                    edgeFaces_[edgeFaceWritePos[e]++] = f;
+                if (edgeFaceCounts_[e] > 0)
+                {
+                    edgeFaces_[edgeFaceOffsets_[e + 1]++] = f;
+                    edgeFaceCounts_[e]--;
+                }
             }
             
             current = he.next;
@@ -305,15 +316,16 @@ void TopologyCache::build(const Mesh& mesh)
     // PHASE 9: Verify CSR consistency (debug only) ===========================
 
 #if SUBDIV_ENABLE_PROFILING
-    for (size_t v = 0; v < numVerts; ++v) 
+    // Leftover capacity means a row was not fully filled
+    for (size_t v = 0; v < numVerts; ++v)
     {
-        if (vertexFaceWritePos[v] != vertexFaceOffsets_[v + 1])
+        if (vertexFaceCounts_[v] != 0)
             SUBDIV_ADD_ERROR(Subdiv::Diagnostics::ErrorSeverity::WARNING,"VERTEX_FACE_CSR_INCOMPLETE", "Vertex-face array not fully filled", "Vertex " + std::to_string(v));
-    }   
+    }
 
-    for (size_t e = 0; e < numEdges; ++e) 
+    for (size_t e = 0; e < numEdges; ++e)
     {
-        if (edgeFaceWritePos[e] != edgeFaceOffsets_[e + 1])
+        if (edgeFaceCounts_[e] != 0)
             SUBDIV_ADD_ERROR(Subdiv::Diagnostics::ErrorSeverity::WARNING, "EDGE_FACE_CSR_INCOMPLETE", "Edge-face array not fully filled", "Edge " + std::to_string(e));
     }
 #endif
@@ -336,7 +348,6 @@ void TopologyCache::clear()
     faceVertices_.clear();
     faceVertexOffsets_.clear();
     faceEdges_.clear();
-    faceEdgeOffsets_.clear();
 
     numBoundaryVertices_ = 0;
     numBoundaryEdges_ = 0;
@@ -392,10 +403,11 @@ std::span<const EdgeIndex> TopologyCache::getFaceEdges(FaceIndex f) const
 {
     SUBDIV_ASSERT(valid_, "TopologyCache not built");
     
-    if (f >= faceEdgeOffsets_.size() - 1) return {};
-    
-    uint32_t start = faceEdgeOffsets_[f];
-    uint32_t end = faceEdgeOffsets_[f + 1];
+    if (f >= faceVertexOffsets_.size() - 1) return {};
+
+    // faceEdges_ shares faceVertexOffsets_ (both hold valence entries per face)
+    uint32_t start = faceVertexOffsets_[f];
+    uint32_t end = faceVertexOffsets_[f + 1];
     return { faceEdges_.data() + start, end - start };
 }
 
@@ -414,8 +426,7 @@ size_t TopologyCache::memoryUsage() const
            edgeFaceOffsets_.size() * sizeof(uint32_t) +
            faceVertices_.size() * sizeof(VertexIndex) +
            faceVertexOffsets_.size() * sizeof(uint32_t) +
-           faceEdges_.size() * sizeof(EdgeIndex) +
-           faceEdgeOffsets_.size() * sizeof(uint32_t);
+           faceEdges_.size() * sizeof(EdgeIndex);
 }
 
 } // namespace Subdiv::Control
\ No newline at end of file
@@ -10,7 +10,7 @@ namespace Subdiv::Diagnostics
 // --- ScopedTimer ---
 
 #if SUBDIV_PROFILING_ENABLED
-ScopedTimer::ScopedTimer(const std::string& name)
+ScopedTimer::ScopedTimer(const char* name)
     : m_name(name)
 {
     if (Context::isEnabled() && Context::getMode() != Context::Mode::ERRORS_ONLY) {
@@ -38,30 +38,22 @@ Context& Context::instance()
 
 void Context::enable(Mode mode)
 {
-    auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    inst.m_mode = mode;
+    instance().m_mode.store(mode, std::memory_order_relaxed);
 }
 
 void Context::disable()
 {
-    auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    inst.m_mode = Mode::DISABLED;
+    instance().m_mode.store(Mode::DISABLED, std::memory_order_relaxed);
 }
 
 bool Context::isEnabled()
 {
-    auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    return inst.m_mode != Mode::DISABLED;
+    return instance().m_mode.load(std::memory_order_relaxed) != Mode::DISABLED;
 }
 
 Context::Mode Context::getMode()
 {
-    auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    return inst.m_mode;
+    return instance().m_mode.load(std::memory_order_relaxed);
 }
 
 // --- Error tracking ---
@@ -70,44 +62,34 @@ void Context::addError(ErrorSeverity severity, const std::string& code,
                            const std::string& message, const std::string& context)
 {
     auto& inst = instance();
+
+    // Check the mode before taking the mutex - the common disabled case
+    // costs one relaxed load
+    if (inst.m_mode.load(std::memory_order_relaxed) == Mode::DISABLED) return;
+
     std::lock_guard<std::mutex> lock(inst.m_mutex);
-    
-    if (inst.m_mode == Mode::DISABLED) return;
-    
     inst.m_errors.emplace_back(severity, code, message, context);
+
+    inst.m_errorCount.fetch_add(1, std::memory_order_relaxed);
+    if (severity == ErrorSeverity::WARNING)
+        inst.m_warningCount.fetch_add(1, std::memory_order_relaxed);
+    else if (severity == ErrorSeverity::FATAL)
+        inst.m_fatalCount.fetch_add(1, std::memory_order_relaxed);
 }
 
 bool Context::hasErrors()
 {
-    auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    return !inst.m_errors.empty();
+    return instance().m_errorCount.load(std::memory_order_relaxed) != 0;
 }
 
 bool Context::hasWarnings()
 {
-    auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    
-    for (const auto& err : inst.m_errors) {
-        if (err.severity == ErrorSeverity::WARNING) {
-            return true;
-        }
-    }
-    return false;
+    return instance().m_warningCount.load(std::memory_order_relaxed) != 0;
 }
 
 bool Context::hasFatalErrors()
 {
-    auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    
-    for (const auto& err : inst.m_errors) {
-        if (err.severity == ErrorSeverity::FATAL) {
-            return true;
-        }
-    }
-    return false;
+    return instance().m_fatalCount.load(std::memory_order_relaxed) != 0;
 }
 
 const std::vector<ErrorInfo>& Context::getErrors()
@@ -177,53 +159,70 @@ std::string Context::getErrorSummary()
 // --- Profiling ---
 
 #if SUBDIV_PROFILING_ENABLED
-void Context::startTimer(const std::string& name)
+void Context::startTimer(std::string_view name)
 {
     auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    
-    if (inst.m_mode != Mode::ERRORS_AND_PROFILING && inst.m_mode != Mode::FULL_DIAGNOSTICS) {
+
+    const Mode mode = inst.m_mode.load(std::memory_order_relaxed);
+    if (mode != Mode::ERRORS_AND_PROFILING && mode != Mode::FULL_DIAGNOSTICS) {
         return;
     }
-    
-    inst.m_activeTimers[name] = std::chrono::high_resolution_clock::now();
+
+    std::lock_guard<std::mutex> lock(inst.m_mutex);
+
+    auto it = inst.m_activeTimers.find(name);
+    if (it == inst.m_activeTimers.end())
+        inst.m_activeTimers.emplace(std::string(name), std::chrono::high_resolution_clock::now());
+    else
+        it->second = std::chrono::high_resolution_clock::now();
 }
 
-void Context::stopTimer(const std::string& name)
+void Context::stopTimer(std::string_view name)
 {
     auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    
-    if (inst.m_mode != Mode::ERRORS_AND_PROFILING && inst.m_mode != Mode::FULL_DIAGNOSTICS) {
+
+    const Mode mode = inst.m_mode.load(std::memory_order_relaxed);
+    if (mode != Mode::ERRORS_AND_PROFILING && mode != Mode::FULL_DIAGNOSTICS) {
         return;
     }
+
+    std::lock_guard<std::mutex> lock(inst.m_mutex);
     
     auto it = inst.m_activeTimers.find(name);
     if (it != inst.m_activeTimers.end()) {
         auto end = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<double, std::milli>(end - it->second).count();
-        recordTiming(name, duration);
+
+        // Record inline - calling recordTiming here would re-lock m_mutex
+        auto tit = inst.m_timings.find(name);
+        if (tit == inst.m_timings.end())
+            tit = inst.m_timings.emplace(std::string(name), TimingInfo(std::string(name))).first;
+        tit->second.addSample(duration);
+
         inst.m_activeTimers.erase(it);
     }
 }
 
-void Context::recordTiming(const std::string& name, double durationMs)
+void Context::recordTiming(std::string_view name, double durationMs)
 {
     auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    
-    if (inst.m_mode != Mode::ERRORS_AND_PROFILING && inst.m_mode != Mode::FULL_DIAGNOSTICS) {
+
+    const Mode mode = inst.m_mode.load(std::memory_order_relaxed);
+    if (mode != Mode::ERRORS_AND_PROFILING && mode != Mode::FULL_DIAGNOSTICS) {
         return;
     }
-    
-    auto& timing = inst.m_timings[name];
-    if (timing.name.empty()) {
-        timing.name = name;
-    }
-    timing.addSample(durationMs);
+
+    std::lock_guard<std::mutex> lock(inst.m_mutex);
+
+    // Heterogeneous lookup - a std::string is built only the first time a
+    // call-site name is seen
+    auto it = inst.m_timings.find(name);
+    if (it == inst.m_timings.end())
+        it = inst.m_timings.emplace(std::string(name), TimingInfo(std::string(name))).first;
+    it->second.addSample(durationMs);
 }
 
-const std::unordered_map<std::string, TimingInfo>& Context::getTimings()
+const Context::TimingMap& Context::getTimings()
 {
     auto& inst = instance();
     std::lock_guard<std::mutex> lock(inst.m_mutex);
@@ -276,38 +275,43 @@ std::string Context::getProfilingSummary()
 // --- Memory tracking ---
 
 #if SUBDIV_MEMORY_TRACKING_ENABLED
-void Context::recordAllocation(const std::string& category, size_t bytes)
+void Context::recordAllocation(std::string_view category, size_t bytes)
 {
     auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    
-    if (inst.m_mode != Mode::FULL_DIAGNOSTICS) {
+
+    if (inst.m_mode.load(std::memory_order_relaxed) != Mode::FULL_DIAGNOSTICS) {
         return;
     }
-    
-    auto& mem = inst.m_memoryTracking[category];
-    if (mem.name.empty()) {
-        mem.name = category;
+
+    std::lock_guard<std::mutex> lock(inst.m_mutex);
+
+    // Heterogeneous lookup - a std::string is built only the first time a
+    // category name is seen (same pattern as the timing maps).
+    auto it = inst.m_memoryTracking.find(category);
+    if (it == inst.m_memoryTracking.end()) {
+        it = inst.m_memoryTracking.emplace(std::string(category),
+                                           MemoryInfo(std::string(category))).first;
     }
-    mem.recordAllocation(bytes);
+    it->second.recordAllocation(bytes);
 }
 
-void Context::recordDeallocation(const std::string& category, size_t bytes)
+void Context::recordDeallocation(std::string_view category, size_t bytes)
 {
     auto& inst = instance();
-    std::lock_guard<std::mutex> lock(inst.m_mutex);
-    
-    if (inst.m_mode != Mode::FULL_DIAGNOSTICS) {
+
+    if (inst.m_mode.load(std::memory_order_relaxed) != Mode::FULL_DIAGNOSTICS) {
         return;
     }
-    
+
+    std::lock_guard<std::mutex> lock(inst.m_mutex);
+
     auto it = inst.m_memoryTracking.find(category);
     if (it != inst.m_memoryTracking.end()) {
         it->second.recordDeallocation(bytes);
     }
 }
 
-const std::unordered_map<std::string, MemoryInfo>& Context::getMemoryInfo()
+const Context::MemoryMap& Context::getMemoryInfo()
 {
     auto& inst = instance();
     std::lock_guard<std::mutex> lock(inst.m_mutex);
@@ -367,6 +371,9 @@ void Context::clear()
     std::lock_guard<std::mutex> lock(inst.m_mutex);
     
     inst.m_errors.clear();
+    inst.m_errorCount.store(0, std::memory_order_relaxed);
+    inst.m_warningCount.store(0, std::memory_order_relaxed);
+    inst.m_fatalCount.store(0, std::memory_order_relaxed);
     
 #if SUBDIV_PROFILING_ENABLED
     inst.m_timings.clear();
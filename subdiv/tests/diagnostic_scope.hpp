@@ -0,0 +1,16 @@
+#pragma once
+
+#include "diagnostics/context.hpp"
+
+// RAII helper for tests - enables error tracking for the enclosing scope
+// and restores the disabled default on exit. Shared by all test files.
+class DiagnosticTestScope {
+public:
+    DiagnosticTestScope() {
+        Subdiv::Diagnostics::Context::enable(Subdiv::Diagnostics::Context::Mode::ERRORS_ONLY);
+        Subdiv::Diagnostics::Context::clear();
+    }
+    ~DiagnosticTestScope() {
+        Subdiv::Diagnostics::Context::disable();
+    }
+};
@@ -3,23 +3,13 @@
 #include "control/mesh.hpp"
 #include "diagnostics/context.hpp"
 
+#include "diagnostic_scope.hpp"
+
 #include <glm/gtc/constants.hpp>
 
 using namespace Subdiv::Control;
 using namespace Subdiv::Diagnostics;
 
-// RAII helper for tests
-class DiagnosticTestScope {
-public:
-    DiagnosticTestScope() {
-        Context::enable(Context::Mode::ERRORS_ONLY);
-        Context::clear();
-    }
-    ~DiagnosticTestScope() {
-        Context::disable();
-    }
-};
-
 TEST_CASE("Mesh - Basic Construction", "[mesh][construction]")
 {
     DiagnosticTestScope diag;
@@ -2,21 +2,11 @@
 #include "control/mesh.hpp"
 #include "diagnostics/context.hpp"
 
+#include "diagnostic_scope.hpp"
+
 using namespace Subdiv::Control;
 using namespace Subdiv::Diagnostics;
 
-// RAII helper for tests
-class DiagnosticTestScope {
-public:
-    DiagnosticTestScope() {
-        Context::enable(Context::Mode::ERRORS_ONLY);
-        Context::clear();
-    }
-    ~DiagnosticTestScope() {
-        Context::disable();
-    }
-};
-
 TEST_CASE("HalfEdge - Basic Properties", "[halfedge]")
 {
     DiagnosticTestScope diag;
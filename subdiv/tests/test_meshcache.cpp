@@ -3,21 +3,11 @@
 #include "control/mesh_cache.hpp"
 #include "diagnostics/context.hpp"
 
+#include "diagnostic_scope.hpp"
+
 using namespace Subdiv::Control;
 using namespace Subdiv::Diagnostics;
 
-// RAII helper for tests
-class DiagnosticTestScope {
-public:
-    DiagnosticTestScope() {
-        Context::enable(Context::Mode::ERRORS_ONLY);
-        Context::clear();
-    }
-    ~DiagnosticTestScope() {
-        Context::disable();
-    }
-};
-
 TEST_CASE("TopologyCache - Lazy Building", "[cache]")
 {
     DiagnosticTestScope diag;